@@ -5,6 +5,7 @@
 #include <locale.h>
 #include <time.h>
 #include <stdarg.h>
+#include "instancia.h"
 
 #define MAX_CITIES 15
 #define MAX_LINE_LENGTH 1024
@@ -19,19 +20,20 @@ typedef struct {
 } State;
 
 // Função para calcular a distância entre duas cidades
-int distance(int city1, int city2, int cost_table[MAX_CITIES][MAX_CITIES]) {
-    return cost_table[city1][city2];
+int distance(int city1, int city2, const Instancia *instance) {
+    return custo(instance, city1, city2);
 }
 
-// Função heurística para estimar o custo restante até o objetivo
-int heuristic(int city, int num_cities, int cost_table[MAX_CITIES][MAX_CITIES], int *visited) {
-    int min_distance = INT_MAX;
-    for (int i = 0; i < num_cities; i++) {
-        if (!visited[i] && cost_table[city][i] < min_distance) {
-            min_distance = cost_table[city][i];
+// Função heurística para estimar o custo restante até o objetivo: o primeiro vizinho
+// não visitado na lista ordenada é o mais próximo
+int heuristic(int city, const Instancia *instance, int *visited) {
+    for (int k = 0; k < instance->n; k++) {
+        int next = vizinho(instance, city, k);
+        if (!visited[next]) {
+            return distance(city, next, instance);
         }
     }
-    return (min_distance == INT_MAX) ? 0 : min_distance;
+    return 0;
 }
 
 // Função para criar um novo estado
@@ -71,7 +73,8 @@ void print_to_both(FILE *file, const char *format, ...) {
 }
 
 // Função para encontrar o caminho ótimo usando o algoritmo A*
-void find_optimal_path(int num_cities, int cost_table[MAX_CITIES][MAX_CITIES], FILE *output_file) {
+void find_optimal_path(const Instancia *instance, FILE *output_file) {
+    int num_cities = instance->n;
     State **open_list = (State **)malloc(num_cities * num_cities * sizeof(State *));
     int open_list_size = 0;
 
@@ -79,22 +82,24 @@ void find_optimal_path(int num_cities, int cost_table[MAX_CITIES][MAX_CITIES], F
     int initial_g = 0;
     int visited[MAX_CITIES] = {0};
     visited[0] = 1; // Marca a cidade inicial como visitada
-    int initial_h = heuristic(0, num_cities, cost_table, visited);
+    int initial_h = heuristic(0, instance, visited);
     State *initial_state = create_state(initial_path, 1, initial_g, initial_g + initial_h, visited);
     open_list[open_list_size++] = initial_state;
 
     int min_cost = INT_MAX;
     int *optimal_path = NULL;
+    long expanded_nodes = 0; // Estados retirados da lista aberta, incluindo rotas completas
     clock_t start_time = clock();
 
     // Loop principal do algoritmo A*
     while (open_list_size > 0) {
         qsort(open_list, open_list_size, sizeof(State *), compare_states); // Ordena a lista de estados abertos
         State *current_state = open_list[--open_list_size];
+        expanded_nodes++;
 
         // Se todas as cidades foram visitadas, calcula o custo final do caminho
         if (current_state->path_length == num_cities) {
-            int final_cost = current_state->g + distance(current_state->path[num_cities - 1], 0, cost_table);
+            int final_cost = current_state->g + distance(current_state->path[num_cities - 1], 0, instance);
             if (final_cost < min_cost) {
                 min_cost = final_cost;
                 if (optimal_path) free(optimal_path);
@@ -112,7 +117,7 @@ void find_optimal_path(int num_cities, int cost_table[MAX_CITIES][MAX_CITIES], F
             if (i == current_state->path[current_state->path_length - 1]) continue;  // Evita revisitar a mesma cidade
             if (current_state->visited[i]) continue; // Evita expandir nós com cidades já visitadas
 
-            int new_g = current_state->g + distance(current_state->path[current_state->path_length - 1], i, cost_table);
+            int new_g = current_state->g + distance(current_state->path[current_state->path_length - 1], i, instance);
             if (new_g >= min_cost) continue;  // Evita expandir nós com custo maior que o menor custo encontrado até agora
 
             int new_path[current_state->path_length + 1];
@@ -123,7 +128,7 @@ void find_optimal_path(int num_cities, int cost_table[MAX_CITIES][MAX_CITIES], F
             memcpy(new_visited, current_state->visited, MAX_CITIES * sizeof(int));
             new_visited[i] = 1; // Marca a cidade como visitada
 
-            int new_h = heuristic(i, num_cities, cost_table, new_visited);
+            int new_h = heuristic(i, instance, new_visited);
             State *new_state = create_state(new_path, current_state->path_length + 1, new_g, new_g + new_h, new_visited);
             open_list[open_list_size++] = new_state;
         }
@@ -150,14 +155,15 @@ void find_optimal_path(int num_cities, int cost_table[MAX_CITIES][MAX_CITIES], F
 
     clock_t end_time = clock();
     double execution_time = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+    print_to_both(output_file, "Nós expandidos: %ld\n", expanded_nodes);
     print_to_both(output_file, "Tempo total de execução: %.2f segundos\n", execution_time);
 }
 
-int main() {
+int main(int argc, char *argv[]) {
     setlocale(LC_ALL, ("Portuguese"));
 
     FILE *file;
-    char filename[] = "cidades.csv";
+    const char *filename = (argc > 1) ? argv[1] : "cidades.csv"; // Pode ser passado como argumento
     char line[MAX_LINE_LENGTH];
     int cost_table[MAX_CITIES][MAX_CITIES];
     int num_cities = 0;
@@ -192,9 +198,18 @@ int main() {
         return 1;
     }
 
+    // Pré-processa a tabela de custos uma única vez
+    Instancia instance;
+    int *rows[MAX_CITIES];
+    for (int i = 0; i < num_cities; i++) {
+        rows[i] = cost_table[i];
+    }
+    preparar_instancia(&instance, num_cities, rows);
+
     // Encontra o caminho ótimo usando o algoritmo A*
-    find_optimal_path(num_cities, cost_table, output_file);
+    find_optimal_path(&instance, output_file);
     fclose(output_file);
+    liberar_instancia(&instance);
 
     return 0;
 }
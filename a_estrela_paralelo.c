@@ -0,0 +1,518 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <locale.h>
+#include <time.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "instancia.h"
+
+#define MAX_CITIES 15
+#define MAX_LINE_LENGTH 1024
+#define MAX_THREADS 64
+#define INITIAL_HEAP_CAPACITY 1024
+#define INITIAL_CLOSED_CAPACITY 1024 // Deve ser potência de 2
+#define CACHE_LINE 64
+
+// Estrutura para armazenar o estado do caminho atual (a do a_estrela.c mais o encadeamento)
+typedef struct State {
+    int *path;              // Caminho atual (capacidade MAX_CITIES, para o estado poder ser reaproveitado)
+    int path_length;        // Comprimento do caminho atual
+    int g;                  // Custo do caminho percorrido até agora
+    int f;                  // Custo estimado total (g + h)
+    int visited[MAX_CITIES]; // Marcador de cidades visitadas
+    struct State *next;     // Próximo estado na caixa de mensagens ou na lista de livres
+} State;
+
+typedef struct Search Search;
+
+// Dados de cada thread: lista aberta, tabela fechada e caixa de mensagens próprias.
+// A estrutura é alinhada à linha de cache e a caixa de mensagens, única parte escrita
+// por outras threads, fica numa linha separada dos campos usados só pela dona.
+typedef struct {
+    _Alignas(CACHE_LINE) int id;
+    pthread_t thread;
+    Search *search;
+
+    State **open_list;      // Heap binário ordenado por f
+    int open_list_size;
+    int open_list_capacity;
+
+    unsigned int *closed_keys; // Chave (cidades visitadas, última cidade); 0 indica posição livre
+    int *closed_g;             // Menor g conhecido para a chave
+    int closed_size;
+    int closed_capacity;
+
+    State *free_states;     // Estados liberados, reaproveitados por create_state
+    int active;             // Se a thread está contada em pending (tem trabalho local)
+    long expansions;        // Estados expandidos por esta thread (sem os descartados), incluindo rotas completas
+
+    _Alignas(CACHE_LINE) _Atomic(State *) mailbox; // Pilha sem trava: várias threads produzem, só a dona consome
+} Worker;
+
+// Contexto compartilhado pela busca paralela
+struct Search {
+    int num_cities;
+    const Instancia *instance;
+    int num_threads;
+    Worker *workers;
+
+    // Mensagens em trânsito mais threads ativas; cada campo disputado tem a própria linha de cache
+    _Alignas(CACHE_LINE) atomic_long pending;
+    _Alignas(CACHE_LINE) atomic_int min_cost; // Custo da melhor rota completa encontrada
+    _Alignas(CACHE_LINE) pthread_mutex_t optimal_lock;
+    int optimal_path[MAX_CITIES + 1];
+};
+
+// Função para calcular a distância entre duas cidades
+int distance(int city1, int city2, const Instancia *instance) {
+    return custo(instance, city1, city2);
+}
+
+// Função heurística para estimar o custo restante até o objetivo: o primeiro vizinho
+// não visitado na lista ordenada é o mais próximo
+int heuristic(int city, const Instancia *instance, int *visited) {
+    for (int k = 0; k < instance->n; k++) {
+        int next = vizinho(instance, city, k);
+        if (!visited[next]) {
+            return distance(city, next, instance);
+        }
+    }
+    return 0;
+}
+
+// Função para criar um novo estado, reaproveitando um estado liberado pela thread quando houver
+State *create_state(Worker *worker, int *path, int path_length, int g, int f, int *visited) {
+    State *state = worker->free_states;
+    if (state != NULL) {
+        worker->free_states = state->next;
+    } else {
+        state = (State *)malloc(sizeof(State));
+        state->path = (int *)malloc(MAX_CITIES * sizeof(int));
+    }
+    memcpy(state->path, path, path_length * sizeof(int));
+    state->path_length = path_length;
+    state->g = g;
+    state->f = f;
+    memcpy(state->visited, visited, MAX_CITIES * sizeof(int));
+    return state;
+}
+
+// Função para devolver um estado à lista de livres da thread; como estados passam de uma
+// thread para outra, nenhuma thread chama o alocador depois que as listas se estabilizam
+void free_state(Worker *worker, State *state) {
+    state->next = worker->free_states;
+    worker->free_states = state;
+}
+
+// Função para liberar a memória dos estados guardados na lista de livres
+void release_free_states(Worker *worker) {
+    while (worker->free_states != NULL) {
+        State *next = worker->free_states->next;
+        free(worker->free_states->path);
+        free(worker->free_states);
+        worker->free_states = next;
+    }
+}
+
+// Função para imprimir tanto no terminal quanto em um arquivo
+void print_to_both(FILE *file, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+
+    vfprintf(stdout, format, args); // Imprime no terminal
+    va_end(args);
+
+    va_start(args, format);
+    vfprintf(file, format, args); // Imprime no arquivo
+    va_end(args);
+}
+
+// Chave do estado: conjunto de cidades visitadas e última cidade do caminho.
+// A cidade 0 está sempre visitada, então a chave nunca é 0.
+unsigned int state_key(const State *state, int num_cities) {
+    unsigned int mask = 0;
+    for (int i = 0; i < num_cities; i++) {
+        if (state->visited[i]) mask |= 1u << i;
+    }
+    return (mask << 4) | (unsigned int)state->path[state->path_length - 1];
+}
+
+// Espalha os bits da chave para distribuir estados entre threads e posições da tabela
+unsigned int hash_key(unsigned int key) {
+    key ^= key >> 16;
+    key *= 0x45d9f3bu;
+    key ^= key >> 16;
+    key *= 0x45d9f3bu;
+    key ^= key >> 16;
+    return key;
+}
+
+// Thread dona da chave. Usa os bits altos do hash, enquanto a tabela fechada usa os baixos;
+// assim as chaves de uma thread continuam espalhadas por todas as posições da tabela dela.
+int owner_of(const Search *search, unsigned int key) {
+    return (int)(((uint64_t)hash_key(key) * (unsigned int)search->num_threads) >> 32);
+}
+
+// Função de comparação do heap: menor f primeiro, em empate o caminho mais longo
+int state_before(const State *a, const State *b) {
+    if (a->f != b->f) return a->f < b->f;
+    return a->path_length > b->path_length;
+}
+
+void heap_push(Worker *worker, State *state) {
+    if (worker->open_list_size == worker->open_list_capacity) {
+        worker->open_list_capacity *= 2;
+        worker->open_list = (State **)realloc(worker->open_list, worker->open_list_capacity * sizeof(State *));
+    }
+    int i = worker->open_list_size++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!state_before(state, worker->open_list[parent])) break;
+        worker->open_list[i] = worker->open_list[parent];
+        i = parent;
+    }
+    worker->open_list[i] = state;
+}
+
+State *heap_pop(Worker *worker) {
+    State *top = worker->open_list[0];
+    State *last = worker->open_list[--worker->open_list_size];
+    int size = worker->open_list_size;
+    int i = 0;
+    while (2 * i + 1 < size) {
+        int child = 2 * i + 1;
+        if (child + 1 < size && state_before(worker->open_list[child + 1], worker->open_list[child])) child++;
+        if (!state_before(worker->open_list[child], last)) break;
+        worker->open_list[i] = worker->open_list[child];
+        i = child;
+    }
+    if (size > 0) worker->open_list[i] = last;
+    return top;
+}
+
+// Procura a chave na tabela fechada; retorna a posição dela ou a posição livre onde deve entrar
+int closed_slot(Worker *worker, unsigned int key) {
+    int mask = worker->closed_capacity - 1;
+    int i = (int)(hash_key(key) & (unsigned int)mask);
+    while (worker->closed_keys[i] != 0 && worker->closed_keys[i] != key) {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+void closed_grow(Worker *worker) {
+    unsigned int *old_keys = worker->closed_keys;
+    int *old_g = worker->closed_g;
+    int old_capacity = worker->closed_capacity;
+
+    worker->closed_capacity *= 2;
+    worker->closed_keys = (unsigned int *)calloc(worker->closed_capacity, sizeof(unsigned int));
+    worker->closed_g = (int *)malloc(worker->closed_capacity * sizeof(int));
+    for (int i = 0; i < old_capacity; i++) {
+        if (old_keys[i] == 0) continue;
+        int slot = closed_slot(worker, old_keys[i]);
+        worker->closed_keys[slot] = old_keys[i];
+        worker->closed_g[slot] = old_g[i];
+    }
+    free(old_keys);
+    free(old_g);
+}
+
+// Recebe um estado pertencente a esta thread: descarta duplicatas piores e insere o resto na lista aberta
+void receive_state(Search *search, Worker *worker, State *state) {
+    unsigned int key = state_key(state, search->num_cities);
+    int slot = closed_slot(worker, key);
+
+    if (worker->closed_keys[slot] == key) {
+        if (worker->closed_g[slot] <= state->g) {
+            free_state(worker, state);
+            return;
+        }
+    } else {
+        if (2 * (worker->closed_size + 1) > worker->closed_capacity) {
+            closed_grow(worker);
+            slot = closed_slot(worker, key);
+        }
+        worker->closed_keys[slot] = key;
+        worker->closed_size++;
+    }
+    worker->closed_g[slot] = state->g;
+    heap_push(worker, state);
+}
+
+// Encaminha um estado para a caixa de mensagens da thread dona; o estado já foi contado em pending
+void send_state(Search *search, int owner, State *state) {
+    Worker *target = &search->workers[owner];
+    state->next = atomic_load_explicit(&target->mailbox, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&target->mailbox, &state->next, state,
+                                                  memory_order_release, memory_order_relaxed)) {
+    }
+}
+
+// Retira de uma vez todas as mensagens da caixa da thread; retorna quantas foram recebidas
+long drain_mailbox(Search *search, Worker *worker) {
+    State *state = atomic_exchange_explicit(&worker->mailbox, NULL, memory_order_acquire);
+    long received = 0;
+    while (state != NULL) {
+        State *next = state->next;
+        receive_state(search, worker, state);
+        state = next;
+        received++;
+    }
+    return received;
+}
+
+// Registra uma rota completa se ela for melhor que a atual
+void update_incumbent(Search *search, State *state, int final_cost) {
+    if (final_cost >= atomic_load(&search->min_cost)) return;
+
+    pthread_mutex_lock(&search->optimal_lock);
+    if (final_cost < atomic_load(&search->min_cost)) {
+        atomic_store(&search->min_cost, final_cost);
+        memcpy(search->optimal_path, state->path, search->num_cities * sizeof(int));
+        search->optimal_path[search->num_cities] = 0; // Adiciona a cidade inicial no final para completar o ciclo
+    }
+    pthread_mutex_unlock(&search->optimal_lock);
+}
+
+// Expande um estado gerando os filhos. Os filhos da própria thread entram direto na lista
+// aberta; os das outras são contados em pending com uma única operação antes de serem enviados.
+void expand_state(Search *search, Worker *worker, State *current_state) {
+    int num_cities = search->num_cities;
+    int last_city = current_state->path[current_state->path_length - 1];
+
+    // Se todas as cidades foram visitadas, calcula o custo final do caminho
+    if (current_state->path_length == num_cities) {
+        update_incumbent(search, current_state, current_state->g + distance(last_city, 0, search->instance));
+        return;
+    }
+
+    int bound = atomic_load_explicit(&search->min_cost, memory_order_relaxed);
+    State *remote[MAX_CITIES];
+    int remote_owner[MAX_CITIES];
+    int num_remote = 0;
+
+    for (int i = 0; i < num_cities; i++) {
+        if (current_state->visited[i]) continue; // Evita expandir nós com cidades já visitadas
+
+        int new_g = current_state->g + distance(last_city, i, search->instance);
+        if (new_g >= bound) continue;
+
+        int new_path[current_state->path_length + 1];
+        memcpy(new_path, current_state->path, current_state->path_length * sizeof(int));
+        new_path[current_state->path_length] = i;
+
+        int new_visited[MAX_CITIES];
+        memcpy(new_visited, current_state->visited, MAX_CITIES * sizeof(int));
+        new_visited[i] = 1; // Marca a cidade como visitada
+
+        int new_h = heuristic(i, search->instance, new_visited);
+        if (new_g + new_h >= bound) continue;
+
+        State *child = create_state(worker, new_path, current_state->path_length + 1, new_g, new_g + new_h, new_visited);
+        int owner = owner_of(search, state_key(child, num_cities));
+        if (owner == worker->id) {
+            receive_state(search, worker, child);
+        } else {
+            remote[num_remote] = child;
+            remote_owner[num_remote] = owner;
+            num_remote++;
+        }
+    }
+
+    if (num_remote > 0) {
+        atomic_fetch_add(&search->pending, num_remote);
+        for (int k = 0; k < num_remote; k++) {
+            send_state(search, remote_owner[k], remote[k]);
+        }
+    }
+}
+
+// Laço de cada thread. pending conta as mensagens em trânsito mais as threads ativas (com
+// lista aberta não vazia): quem envia conta a mensagem antes de publicá-la e quem recebe se
+// ativa na mesma operação que desconta as mensagens. Assim pending só chega a zero quando
+// nenhuma thread tem trabalho e nenhuma mensagem está a caminho, ou seja, depois que todo
+// estado com f menor que o ótimo foi expandido. Threads ativas não leem pending.
+void *run_worker(void *arg) {
+    Worker *worker = (Worker *)arg;
+    Search *search = worker->search;
+
+    for (;;) {
+        long received = drain_mailbox(search, worker);
+        if (received > 0) {
+            atomic_fetch_add(&search->pending, (worker->active ? 0 : 1) - received);
+            worker->active = 1;
+        }
+
+        if (worker->open_list_size == 0) {
+            if (worker->active) {
+                worker->active = 0;
+                atomic_fetch_sub(&search->pending, 1);
+            }
+            if (atomic_load(&search->pending) == 0) break;
+            sched_yield();
+            continue;
+        }
+
+        State *current_state = heap_pop(worker);
+        int slot = closed_slot(worker, state_key(current_state, search->num_cities));
+
+        // Descarta estados superados por uma duplicata melhor ou podados pela melhor rota atual
+        if (worker->closed_g[slot] == current_state->g &&
+            current_state->f < atomic_load_explicit(&search->min_cost, memory_order_relaxed)) {
+            expand_state(search, worker, current_state);
+            worker->expansions++;
+        }
+
+        free_state(worker, current_state);
+    }
+    return NULL;
+}
+
+// Função para encontrar o caminho ótimo usando A* paralelo distribuído por hash (HDA*)
+void find_optimal_path_parallel(const Instancia *instance, int num_threads, FILE *output_file) {
+    int num_cities = instance->n;
+    Search search;
+    search.num_cities = num_cities;
+    search.instance = instance;
+    search.num_threads = num_threads;
+    search.workers = (Worker *)aligned_alloc(CACHE_LINE, num_threads * sizeof(Worker));
+    memset(search.workers, 0, num_threads * sizeof(Worker));
+    atomic_init(&search.pending, 0);
+    atomic_init(&search.min_cost, INT_MAX);
+    pthread_mutex_init(&search.optimal_lock, NULL);
+
+    for (int t = 0; t < num_threads; t++) {
+        Worker *worker = &search.workers[t];
+        worker->id = t;
+        worker->search = &search;
+        worker->open_list_capacity = INITIAL_HEAP_CAPACITY;
+        worker->open_list = (State **)malloc(worker->open_list_capacity * sizeof(State *));
+        worker->closed_capacity = INITIAL_CLOSED_CAPACITY;
+        worker->closed_keys = (unsigned int *)calloc(worker->closed_capacity, sizeof(unsigned int));
+        worker->closed_g = (int *)malloc(worker->closed_capacity * sizeof(int));
+        atomic_init(&worker->mailbox, NULL);
+    }
+
+    int initial_path[1] = {0};
+    int visited[MAX_CITIES] = {0};
+    visited[0] = 1; // Marca a cidade inicial como visitada
+    int initial_h = heuristic(0, instance, visited);
+    State *initial_state = create_state(&search.workers[0], initial_path, 1, 0, initial_h, visited);
+    Worker *first = &search.workers[owner_of(&search, state_key(initial_state, num_cities))];
+    receive_state(&search, first, initial_state);
+    first->active = 1;
+    atomic_store(&search.pending, 1);
+
+    struct timespec start_time, end_time;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    for (int t = 0; t < num_threads; t++) {
+        pthread_create(&search.workers[t].thread, NULL, run_worker, &search.workers[t]);
+    }
+    for (int t = 0; t < num_threads; t++) {
+        pthread_join(search.workers[t].thread, NULL);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    double execution_time = (end_time.tv_sec - start_time.tv_sec) + (end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+
+    // Imprime o resultado final
+    int min_cost = atomic_load(&search.min_cost);
+    if (min_cost != INT_MAX) {
+        print_to_both(output_file, "Caminho ótimo: ");
+        for (int i = 0; i <= num_cities; i++) {
+            print_to_both(output_file, "%d ", search.optimal_path[i]);
+        }
+        print_to_both(output_file, "\nCusto mínimo: %d\n", min_cost);
+    } else {
+        print_to_both(output_file, "Nenhum caminho encontrado.\n");
+    }
+
+    long total_expansions = 0;
+    for (int t = 0; t < num_threads; t++) {
+        print_to_both(output_file, "Thread %d: %ld expansões\n", t, search.workers[t].expansions);
+        total_expansions += search.workers[t].expansions;
+    }
+    print_to_both(output_file, "Threads: %d\n", num_threads);
+    print_to_both(output_file, "Nós expandidos: %ld\n", total_expansions);
+    if (execution_time > 0) {
+        print_to_both(output_file, "Expansões por segundo: %.0f\n", total_expansions / execution_time);
+    }
+    print_to_both(output_file, "Tempo total de execução: %.2f segundos\n", execution_time);
+
+    for (int t = 0; t < num_threads; t++) {
+        free(search.workers[t].open_list);
+        free(search.workers[t].closed_keys);
+        free(search.workers[t].closed_g);
+        release_free_states(&search.workers[t]);
+    }
+    free(search.workers);
+    pthread_mutex_destroy(&search.optimal_lock);
+}
+
+int main(int argc, char *argv[]) {
+    setlocale(LC_ALL, ("Portuguese"));
+
+    FILE *file;
+    const char *filename = (argc > 2) ? argv[2] : "cidades.csv"; // Segundo argumento opcional
+    char line[MAX_LINE_LENGTH];
+    int cost_table[MAX_CITIES][MAX_CITIES];
+    int num_cities = 0;
+
+    // Número de threads: primeiro argumento ou número de processadores disponíveis
+    int num_threads = (argc > 1) ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_threads < 1) num_threads = 1;
+    if (num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+
+    // Abre o arquivo CSV para ler a tabela de custos entre as cidades
+    file = fopen(filename, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Não foi possível abrir o arquivo %s\n", filename);
+        return 1;
+    }
+
+    // Lê a tabela de custos do arquivo CSV
+    while (fgets(line, sizeof(line), file) && num_cities < MAX_CITIES) {
+        char *token;
+        int column = 0;
+        token = strtok(line, ",");
+        while (token != NULL && column < MAX_CITIES) {
+            cost_table[num_cities][column] = atoi(token);
+            token = strtok(NULL, ",");
+            column++;
+        }
+        num_cities++;
+    }
+
+    printf("Número de cidades: %d\n", num_cities);
+    fclose(file);
+
+    // Abre o arquivo de saída para escrever os resultados
+    FILE *output_file = fopen("a_estrela_paralelo_result.txt", "w");
+    if (output_file == NULL) {
+        fprintf(stderr, "Não foi possível abrir o arquivo a_estrela_paralelo_result.txt\n");
+        return 1;
+    }
+
+    // Pré-processa a tabela de custos uma única vez; as threads só leem a instância
+    Instancia instance;
+    int *rows[MAX_CITIES];
+    for (int i = 0; i < num_cities; i++) {
+        rows[i] = cost_table[i];
+    }
+    preparar_instancia(&instance, num_cities, rows);
+
+    // Encontra o caminho ótimo usando o A* paralelo
+    find_optimal_path_parallel(&instance, num_threads, output_file);
+    fclose(output_file);
+    liberar_instancia(&instance);
+
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include <string.h>
 #include <math.h>
 #include <time.h>
+#include "instancia.h"
 
 #define NUM_CITIES 15 // Número de cidades
 #define POP_SIZE 100 // Tamanho da população
@@ -16,7 +17,7 @@ typedef struct {
     double fitness; 
 } Individual;
 
-double cost_matrix[NUM_CITIES][NUM_CITIES]; // Matriz de custos
+Instancia instance; // Matriz de custos pré-processada
 
 // Função para inicializar a matriz de custos a partir de um arquivo CSV
 void initialize_cost_matrix_from_file(const char *filename) {
@@ -28,6 +29,7 @@ void initialize_cost_matrix_from_file(const char *filename) {
     }
 
     char line[1024];
+    int cost_matrix[NUM_CITIES][NUM_CITIES];
 
     for (int i = 0; i < NUM_CITIES; i++) {
         if (fgets(line, sizeof(line), file) == NULL) {
@@ -41,11 +43,17 @@ void initialize_cost_matrix_from_file(const char *filename) {
                 fprintf(stderr, "Erro ao ler o arquivo\n");
                 exit(1);
             }
-            cost_matrix[i][j] = atof(token);
+            cost_matrix[i][j] = atoi(token);
             token = strtok(NULL, ",");
         }
     }
     fclose(file);
+
+    int *rows[NUM_CITIES];
+    for (int i = 0; i < NUM_CITIES; i++) {
+        rows[i] = cost_matrix[i];
+    }
+    preparar_instancia(&instance, NUM_CITIES, rows);
 }
 
 // Função para inicializar um indivíduo com uma rota aleatória
@@ -71,10 +79,10 @@ void calculate_fitness(Individual *individual) {
 
     // Calcule a distância total da rota
     for (int i = 0; i < NUM_CITIES - 1; i++) {
-        total_distance += cost_matrix[individual->route[i]][individual->route[i + 1]];
+        total_distance += custo(&instance, individual->route[i], individual->route[i + 1]);
     }
     // Adicione a distância da última cidade de volta para a primeira
-    total_distance += cost_matrix[individual->route[NUM_CITIES - 1]][individual->route[0]];
+    total_distance += custo(&instance, individual->route[NUM_CITIES - 1], individual->route[0]);
     
     // O fitness é o inverso da distância total (menor distância = fitness maior)
     individual->fitness = 1.0 / total_distance;
@@ -212,10 +220,10 @@ void genetic_algorithm() {
     // Calcular o custo do caminho escolhido
     double total_distance = 0;
     for (int i = 0; i < NUM_CITIES - 1; i++) {
-        total_distance += cost_matrix[best_individual.route[i]][best_individual.route[i + 1]];
+        total_distance += custo(&instance, best_individual.route[i], best_individual.route[i + 1]);
     }
     // Adicione a distância da última cidade de volta para a primeira
-    total_distance += cost_matrix[best_individual.route[NUM_CITIES - 1]][best_individual.route[0]];
+    total_distance += custo(&instance, best_individual.route[NUM_CITIES - 1], best_individual.route[0]);
 
     clock_t end_time = clock(); // Finalizar a medição do tempo
     double simulation_time = ((double) (end_time - start_time)) / CLOCKS_PER_SEC;
@@ -231,6 +239,7 @@ void genetic_algorithm() {
 
     // Exportar resultados para um arquivo de texto
     export_results_to_file("resultados_geneticos.txt", best_individual, total_distance, simulation_time);
+    liberar_instancia(&instance);
 }
 
 int main() {
@@ -0,0 +1,129 @@
+#ifndef INSTANCIA_H
+#define INSTANCIA_H
+
+// Pré-processamento comum a todos os algoritmos: montado uma vez por instância,
+// guarda a matriz de custos no menor tipo que comporta os valores, as listas de
+// vizinhos ordenadas por custo e a menor aresta de saída de cada cidade.
+// A matriz estreitada só reduz o tempo quando a matriz int deixaria de caber no cache L1
+// (a partir de umas 90 cidades); nas instâncias do repositório a diferença fica no ruído.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// Tipo usado para armazenar cada custo da matriz
+typedef enum {
+    CUSTO_8,  // uint8_t: todos os custos entre 0 e 255
+    CUSTO_16, // uint16_t: todos os custos entre 0 e 65535
+    CUSTO_32  // int: qualquer outro caso
+} TipoCusto;
+
+typedef struct {
+    int n;                 // Número de cidades
+    TipoCusto tipo;        // Tipo dos elementos de custos
+    bool simetrica;        // Se verdadeiro, só o triângulo inferior (i >= j) é guardado
+    void* custos;          // n * n custos, ou n * (n + 1) / 2 se simétrica
+    uint16_t* vizinhos;    // vizinhos[i * n + k]: k-ésima cidade mais barata a partir de i (inclui a própria i)
+    int* min_saida;        // Menor custo de uma aresta saindo de cada cidade
+} Instancia;
+
+// Posição do custo (i, j) no vetor de custos
+static inline int indice_custo(const Instancia* inst, int i, int j) {
+    if (!inst->simetrica) return i * inst->n + j;
+    if (i < j) {
+        int temp = i;
+        i = j;
+        j = temp;
+    }
+    return i * (i + 1) / 2 + j;
+}
+
+// Função para consultar o custo da aresta (i, j)
+static inline int custo(const Instancia* inst, int i, int j) {
+    int k = indice_custo(inst, i, j);
+    switch (inst->tipo) {
+        case CUSTO_8:  return ((const uint8_t*)inst->custos)[k];
+        case CUSTO_16: return ((const uint16_t*)inst->custos)[k];
+        default:       return ((const int*)inst->custos)[k];
+    }
+}
+
+// Função para consultar a k-ésima cidade mais barata a partir de i
+static inline int vizinho(const Instancia* inst, int i, int k) {
+    return inst->vizinhos[i * inst->n + k];
+}
+
+// Monta a instância a partir das linhas da matriz de custos (linhas[i][j] é o custo de i para j)
+static void preparar_instancia(Instancia* inst, int n, int* const* linhas) {
+    inst->n = n;
+
+    // Escolhe o menor tipo que comporta todos os custos e verifica a simetria
+    int menor = 0, maior = 0;
+    inst->simetrica = true;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (linhas[i][j] < menor) menor = linhas[i][j];
+            if (linhas[i][j] > maior) maior = linhas[i][j];
+            if (linhas[i][j] != linhas[j][i]) inst->simetrica = false;
+        }
+    }
+    if (menor >= 0 && maior <= UINT8_MAX) {
+        inst->tipo = CUSTO_8;
+    } else if (menor >= 0 && maior <= UINT16_MAX) {
+        inst->tipo = CUSTO_16;
+    } else {
+        inst->tipo = CUSTO_32;
+    }
+
+    int tamanho = inst->simetrica ? n * (n + 1) / 2 : n * n;
+    size_t bytes = (inst->tipo == CUSTO_8) ? sizeof(uint8_t) : (inst->tipo == CUSTO_16) ? sizeof(uint16_t) : sizeof(int);
+    inst->custos = malloc(tamanho * bytes);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (inst->simetrica && j > i) break;
+            int k = indice_custo(inst, i, j);
+            switch (inst->tipo) {
+                case CUSTO_8:  ((uint8_t*)inst->custos)[k] = (uint8_t)linhas[i][j]; break;
+                case CUSTO_16: ((uint16_t*)inst->custos)[k] = (uint16_t)linhas[i][j]; break;
+                default:       ((int*)inst->custos)[k] = linhas[i][j]; break;
+            }
+        }
+    }
+
+    // Ordena cada linha por custo (ordenação por inserção, estável para empates)
+    inst->vizinhos = (uint16_t*)malloc(n * n * sizeof(uint16_t));
+    for (int i = 0; i < n; i++) {
+        uint16_t* linha = &inst->vizinhos[i * n];
+        for (int j = 0; j < n; j++) {
+            int k = j;
+            while (k > 0 && linhas[i][linha[k - 1]] > linhas[i][j]) {
+                linha[k] = linha[k - 1];
+                k--;
+            }
+            linha[k] = (uint16_t)j;
+        }
+    }
+
+    // Menor aresta de saída de cada cidade, ignorando a diagonal
+    inst->min_saida = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        inst->min_saida[i] = 0;
+        bool primeira = true;
+        for (int j = 0; j < n; j++) {
+            if (i == j) continue;
+            if (primeira || linhas[i][j] < inst->min_saida[i]) {
+                inst->min_saida[i] = linhas[i][j];
+                primeira = false;
+            }
+        }
+    }
+}
+
+// Função para liberar a memória da instância
+static void liberar_instancia(Instancia* inst) {
+    free(inst->custos);
+    free(inst->vizinhos);
+    free(inst->min_saida);
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h> // Biblioteca para manipulação de tempo
+#include "instancia.h" // Matriz de custos compacta e vizinhos ordenados
 
 #define INFINITO 999999 // Definindo um valor grande para representar infinito
 
@@ -74,7 +75,10 @@ int** ler_custos(const char* nome_arquivo, int* tamanho) {
 
 
 // Função recursiva para encontrar a melhor rota através de busca em profundidade
-void tsp_dfs(int cidade_atual, int custo_atual, int** custos, bool* visitados, int n, int* melhor_custo, int* melhor_rota, int* rota_atual, int posicao_atual) {
+void tsp_dfs(int cidade_atual, int custo_atual, const Instancia* instancia, bool* visitados, int* melhor_custo, int* melhor_rota, int* rota_atual, int posicao_atual, long* nos_visitados) {
+    (*nos_visitados)++; // Conta cada chamada, isto é, cada rota parcial gerada (incluindo as completas)
+    int n = instancia->n;
+
     // Verifica se todas as cidades foram visitadas
     bool todas_visitadas = true;
     for (int i = 0; i < n; i++) {
@@ -86,9 +90,11 @@ void tsp_dfs(int cidade_atual, int custo_atual, int** custos, bool* visitados, i
 
     // Se todas as cidades foram visitadas
     if (todas_visitadas) {
-        // Verifica se o custo atual é menor que o melhor custo encontrado até agora
-        if (custo_atual < *melhor_custo) {
-            *melhor_custo = custo_atual; // Atualiza o melhor custo
+        // Soma a aresta de volta para a cidade inicial para fechar o ciclo
+        int custo_ciclo = custo_atual + custo(instancia, cidade_atual, 0);
+        // Verifica se o custo do ciclo é menor que o melhor custo encontrado até agora
+        if (custo_ciclo < *melhor_custo) {
+            *melhor_custo = custo_ciclo; // Atualiza o melhor custo
             // Copia a rota atual para a melhor rota
             for (int i = 0; i < n; i++) {
                 melhor_rota[i] = rota_atual[i];
@@ -97,15 +103,16 @@ void tsp_dfs(int cidade_atual, int custo_atual, int** custos, bool* visitados, i
         return; // Retorna da função recursiva
     }
 
-    // Percorre todas as cidades
-    for (int prox_cidade = 0; prox_cidade < n; prox_cidade++) {
+    // Percorre as cidades da mais próxima para a mais distante
+    for (int k = 0; k < n; k++) {
+        int prox_cidade = vizinho(instancia, cidade_atual, k);
         // Se a próxima cidade ainda não foi visitada
         if (!visitados[prox_cidade]) {
             visitados[prox_cidade] = true; // Marca a cidade como visitada
             // Adiciona a cidade na rota atual
             rota_atual[posicao_atual] = prox_cidade;
             // Chama recursivamente a função para a próxima cidade
-            tsp_dfs(prox_cidade, custo_atual + custos[cidade_atual][prox_cidade], custos, visitados, n, melhor_custo, melhor_rota, rota_atual, posicao_atual + 1);
+            tsp_dfs(prox_cidade, custo_atual + custo(instancia, cidade_atual, prox_cidade), instancia, visitados, melhor_custo, melhor_rota, rota_atual, posicao_atual + 1, nos_visitados);
             visitados[prox_cidade] = false; // Desmarca a cidade como visitada
         }
     }
@@ -114,7 +121,7 @@ void tsp_dfs(int cidade_atual, int custo_atual, int** custos, bool* visitados, i
 // Função para escrever os resultados em um arquivo
 
 // Função para escrever os resultados em um arquivo
-void escrever_resultados(const char* nome_arquivo, int melhor_custo, int* melhor_rota, int n, double tempo_execucao) {
+void escrever_resultados(const char* nome_arquivo, int melhor_custo, int* melhor_rota, int n, long nos_visitados, double tempo_execucao) {
     // Abre o arquivo para escrita
     FILE* file = fopen(nome_arquivo, "w");
     if (!file) {
@@ -131,7 +138,8 @@ void escrever_resultados(const char* nome_arquivo, int melhor_custo, int* melhor
     for (int i = 0; i < n; i++) {
         fprintf(file, "%d ", melhor_rota[i] + 1); // Incrementa o índice em 1 para obter a cidade real
     }
-    fprintf(file, "\nTempo de execução: %.2f segundos\n", tempo_execucao); // Escreve o tempo de execução
+    fprintf(file, "\nNós visitados: %ld\n", nos_visitados); // Escreve o número de nós visitados
+    fprintf(file, "Tempo de execução: %.2f segundos\n", tempo_execucao); // Escreve o tempo de execução
 
     // Fecha o arquivo
     fclose(file);
@@ -144,29 +152,40 @@ void encontrar_melhor_rota(const char* nome_arquivo) {
     // Lê a matriz de custos do arquivo
     int** custos = ler_custos(nome_arquivo, &n);
 
+    // Pré-processa a matriz de custos uma única vez
+    Instancia instancia;
+    preparar_instancia(&instancia, n, custos);
+    for (int i = 0; i < n; i++) {
+        free(custos[i]);
+    }
+    free(custos);
+
     // Declaração de variáveis
     bool visitados[n];
     int melhor_custo = INFINITO;
     int melhor_rota[n];
     int rota_atual[n];
+    long nos_visitados = 0;
 
-    // Inicializa o vetor de cidades visitadas
+    // Inicializa o vetor de cidades visitadas; a rota sempre começa na cidade 0
     for (int i = 0; i < n; i++) {
         visitados[i] = false;
     }
+    visitados[0] = true;
+    rota_atual[0] = 0;
 
     // Inicia a contagem do tempo de execução
     clock_t inicio = clock();
 
     // Chama a função recursiva para encontrar a melhor rota
-    tsp_dfs(0, 0, custos, visitados, n, &melhor_custo, melhor_rota, rota_atual, 0);
+    tsp_dfs(0, 0, &instancia, visitados, &melhor_custo, melhor_rota, rota_atual, 1, &nos_visitados);
 
     // Finaliza a contagem do tempo de execução
     clock_t fim = clock();
     double tempo_execucao = (double)(fim - inicio) / CLOCKS_PER_SEC; // Calcula o tempo de execução
 
     // Escreve os resultados no arquivo
-    escrever_resultados("Profundidade_resultado.txt", melhor_custo, melhor_rota, n, tempo_execucao);
+    escrever_resultados("Profundidade_resultado.txt", melhor_custo, melhor_rota, n, nos_visitados, tempo_execucao);
 
     // Exibe os resultados no console
     printf("Melhor custo encontrado: %d\n", melhor_custo);
@@ -174,11 +193,15 @@ void encontrar_melhor_rota(const char* nome_arquivo) {
     for (int i = 0; i < n; i++) {
         printf("%d ", melhor_rota[i] + 1); // Incrementa o índice em 1 para obter a cidade real
     }
-    printf("\nTempo de execução: %.2f segundos\n", tempo_execucao);
+    printf("\nNós visitados: %ld\n", nos_visitados);
+    printf("Tempo de execução: %.2f segundos\n", tempo_execucao);
+
+    liberar_instancia(&instancia);
 }
 // Função principal
-int main() {
-    const char* nome_arquivo = "cidades9.csv"; // Nome do arquivo CSV contendo os custos
+int main(int argc, char* argv[]) {
+    // Nome do arquivo CSV contendo os custos (pode ser passado como argumento)
+    const char* nome_arquivo = (argc > 1) ? argv[1] : "cidades9.csv";
 
     // Chama a função para encontrar a melhor rota
     encontrar_melhor_rota(nome_arquivo); 
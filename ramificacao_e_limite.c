@@ -0,0 +1,539 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <time.h> // Biblioteca para manipulação de tempo
+#include "instancia.h" // Matriz de custos compacta e vizinhos ordenados
+
+#define INFINITO INT_MAX // Marca as células proibidas; custos válidos ficam abaixo deste valor
+
+// Alteração registrada na trilha para poder ser desfeita ao voltar na árvore de busca
+typedef struct {
+    int* endereco;    // Posição alterada
+    int valor_antigo; // Valor antes da alteração
+} Alteracao;
+
+// Estado do algoritmo de Little: a matriz reduzida é alterada no lugar e cada
+// alteração vai para a trilha, então um nó custa só as células que ele mudou
+typedef struct {
+    int n;
+    const Instancia* instancia; // Custos originais
+    int** matriz;         // Matriz reduzida do nó atual
+    int* linha_ativa;     // Linhas ainda sem aresta de saída escolhida
+    int* coluna_ativa;    // Colunas ainda sem aresta de entrada escolhida
+    int* inicio;          // inicio[v]: primeira cidade do fragmento que termina em v
+    int* fim;             // fim[v]: última cidade do fragmento que começa em v
+    int* sucessor;        // Arestas incluídas (cidade -> próxima cidade)
+    int arestas_incluidas;
+    int limite;           // Limite inferior do nó atual (soma das reduções)
+
+    Alteracao* trilha;
+    int topo_trilha;
+    int capacidade_trilha;
+
+    long nos;             // Nós expandidos: subproblemas tirados para ramificar (folhas incluídas)
+    int melhor_custo;
+    int* melhor_sucessor;
+} Problema;
+
+// Nó da busca pelo melhor limite: guarda só a decisão tomada em relação ao pai
+typedef struct No {
+    struct No* pai;
+    int i, j;             // Aresta da decisão
+    bool inclui;          // true: aresta incluída; false: aresta excluída
+    int limite;
+    int profundidade;
+} No;
+
+// Função para ler os custos entre as cidades a partir de um arquivo CSV
+int** ler_custos(const char* nome_arquivo, int* tamanho) {
+
+    // Abre o arquivo para leitura
+    FILE* file = fopen(nome_arquivo, "r");
+    if (!file) {
+        // Se ocorrer um erro ao abrir o arquivo, exibe uma mensagem e encerra o programa
+        printf("Erro ao abrir o arquivo %s\n", nome_arquivo);
+        exit(EXIT_FAILURE);
+    }
+
+    int** custos; // Declaração da matriz de custos
+    int linhas = 0; // Contador de linhas
+    int colunas = 0; // Contador de colunas
+    char linha[BUFSIZ]; // Buffer para leitura de linhas
+
+    // Contando o número de linhas e colunas no arquivo
+    while (fgets(linha, sizeof(linha), file)) {
+        linhas++;
+        colunas = 0;
+
+        char* token = strtok(linha, ",");
+        while (token != NULL) {
+            colunas++;
+            token = strtok(NULL, ",");
+        }
+    }
+
+    // Define o tamanho da matriz (número de linhas)
+    *tamanho = linhas;
+
+    // Alocando espaço para a matriz de custos
+    custos = (int**)malloc(linhas * sizeof(int*));
+    for (int i = 0; i < linhas; i++) {
+        custos[i] = (int*)malloc(colunas * sizeof(int));
+    }
+
+    // Voltando ao início do arquivo
+    rewind(file);
+
+    int i = 0;
+    // Preenchendo a matriz de custos com os valores do arquivo
+    while (fgets(linha, sizeof(linha), file)) {
+        int j = 0;
+        char* token = strtok(linha, ",");
+        while (token != NULL) {
+            custos[i][j++] = atoi(token);
+            token = strtok(NULL, ",");
+        }
+        i++;
+    }
+
+    fclose(file);
+    return custos;
+}
+
+// Grava o valor antigo na trilha e altera a posição
+void atribuir(Problema* p, int* endereco, int valor) {
+    if (p->topo_trilha == p->capacidade_trilha) {
+        p->capacidade_trilha *= 2;
+        p->trilha = (Alteracao*)realloc(p->trilha, p->capacidade_trilha * sizeof(Alteracao));
+    }
+    p->trilha[p->topo_trilha].endereco = endereco;
+    p->trilha[p->topo_trilha].valor_antigo = *endereco;
+    p->topo_trilha++;
+    *endereco = valor;
+}
+
+// Desfaz as alterações até a marca indicada da trilha
+void desfazer(Problema* p, int marca) {
+    while (p->topo_trilha > marca) {
+        p->topo_trilha--;
+        *p->trilha[p->topo_trilha].endereco = p->trilha[p->topo_trilha].valor_antigo;
+    }
+}
+
+// Soma ao limite sem estourar: resultados acima de INFINITO ficam em INFINITO e o nó é podado
+int somar_limitado(int a, long long b) {
+    long long soma = (long long)a + b;
+    return (soma >= INFINITO) ? INFINITO : (int)soma;
+}
+
+// Reduz as linhas e colunas ativas até cada uma ter um zero e soma a redução ao limite.
+// Retorna false se alguma linha ou coluna ficou sem aresta possível.
+bool reduzir(Problema* p) {
+    int n = p->n;
+    long long reducao = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (!p->linha_ativa[i]) continue;
+        int minimo = INFINITO;
+        for (int j = 0; j < n; j++) {
+            if (p->coluna_ativa[j] && p->matriz[i][j] < minimo) minimo = p->matriz[i][j];
+        }
+        if (minimo == INFINITO) return false;
+        if (minimo == 0) continue;
+        for (int j = 0; j < n; j++) {
+            if (p->coluna_ativa[j] && p->matriz[i][j] != INFINITO) {
+                atribuir(p, &p->matriz[i][j], p->matriz[i][j] - minimo);
+            }
+        }
+        reducao += minimo;
+    }
+
+    for (int j = 0; j < n; j++) {
+        if (!p->coluna_ativa[j]) continue;
+        int minimo = INFINITO;
+        for (int i = 0; i < n; i++) {
+            if (p->linha_ativa[i] && p->matriz[i][j] < minimo) minimo = p->matriz[i][j];
+        }
+        if (minimo == INFINITO) return false;
+        if (minimo == 0) continue;
+        for (int i = 0; i < n; i++) {
+            if (p->linha_ativa[i] && p->matriz[i][j] != INFINITO) {
+                atribuir(p, &p->matriz[i][j], p->matriz[i][j] - minimo);
+            }
+        }
+        reducao += minimo;
+    }
+
+    if (reducao > 0) atribuir(p, &p->limite, somar_limitado(p->limite, reducao));
+    return true;
+}
+
+// Escolhe, entre as células zeradas, a aresta cuja exclusão mais aumenta o limite
+bool escolher_aresta(Problema* p, int* melhor_i, int* melhor_j) {
+    int n = p->n;
+    int menor_linha[n], segundo_linha[n], posicao_linha[n];
+    int menor_coluna[n], segundo_coluna[n], posicao_coluna[n];
+
+    for (int k = 0; k < n; k++) {
+        menor_linha[k] = segundo_linha[k] = menor_coluna[k] = segundo_coluna[k] = INFINITO;
+        posicao_linha[k] = posicao_coluna[k] = -1;
+    }
+
+    // Os dois menores valores de cada linha e coluna ativas
+    for (int i = 0; i < n; i++) {
+        if (!p->linha_ativa[i]) continue;
+        for (int j = 0; j < n; j++) {
+            if (!p->coluna_ativa[j]) continue;
+            int valor = p->matriz[i][j];
+            if (valor < menor_linha[i]) {
+                segundo_linha[i] = menor_linha[i];
+                menor_linha[i] = valor;
+                posicao_linha[i] = j;
+            } else if (valor < segundo_linha[i]) {
+                segundo_linha[i] = valor;
+            }
+            if (valor < menor_coluna[j]) {
+                segundo_coluna[j] = menor_coluna[j];
+                menor_coluna[j] = valor;
+                posicao_coluna[j] = i;
+            } else if (valor < segundo_coluna[j]) {
+                segundo_coluna[j] = valor;
+            }
+        }
+    }
+
+    int melhor_penalidade = -1;
+    for (int i = 0; i < n; i++) {
+        if (!p->linha_ativa[i]) continue;
+        for (int j = 0; j < n; j++) {
+            if (!p->coluna_ativa[j] || p->matriz[i][j] != 0) continue;
+            int penalidade_linha = (posicao_linha[i] == j) ? segundo_linha[i] : menor_linha[i];
+            int penalidade_coluna = (posicao_coluna[j] == i) ? segundo_coluna[j] : menor_coluna[j];
+            int penalidade = somar_limitado(penalidade_linha, penalidade_coluna);
+            if (penalidade > melhor_penalidade) {
+                melhor_penalidade = penalidade;
+                *melhor_i = i;
+                *melhor_j = j;
+            }
+        }
+    }
+    return melhor_penalidade >= 0;
+}
+
+// Inclui a aresta (i, j): remove a linha e a coluna, junta os fragmentos e proíbe o subciclo
+bool incluir(Problema* p, int i, int j) {
+    atribuir(p, &p->linha_ativa[i], 0);
+    atribuir(p, &p->coluna_ativa[j], 0);
+    atribuir(p, &p->sucessor[i], j);
+
+    int primeira = p->inicio[i];
+    int ultima = p->fim[j];
+    atribuir(p, &p->fim[primeira], ultima);
+    atribuir(p, &p->inicio[ultima], primeira);
+    atribuir(p, &p->arestas_incluidas, p->arestas_incluidas + 1);
+
+    // Fechar o fragmento antes de usar todas as cidades formaria um subciclo
+    if (p->arestas_incluidas < p->n - 1) {
+        atribuir(p, &p->matriz[ultima][primeira], INFINITO);
+    }
+    return reduzir(p);
+}
+
+// Exclui a aresta (i, j) e reduz novamente a linha e a coluna afetadas
+bool excluir(Problema* p, int i, int j) {
+    atribuir(p, &p->matriz[i][j], INFINITO);
+    return reduzir(p);
+}
+
+bool aplicar_decisao(Problema* p, const No* no) {
+    return no->inclui ? incluir(p, no->i, no->j) : excluir(p, no->i, no->j);
+}
+
+// Registra o ciclo completo do nó atual se ele for melhor que o atual
+void registrar_rota(Problema* p) {
+    int custo_rota = 0;
+    for (int i = 0; i < p->n; i++) {
+        custo_rota = somar_limitado(custo_rota, custo(p->instancia, i, p->sucessor[i]));
+    }
+    if (custo_rota < p->melhor_custo) {
+        p->melhor_custo = custo_rota;
+        memcpy(p->melhor_sucessor, p->sucessor, p->n * sizeof(int));
+    }
+}
+
+// Busca em profundidade: inclusão primeiro, depois exclusão, desfazendo pela trilha
+void busca_profundidade(Problema* p) {
+    p->nos++;
+
+    if (p->arestas_incluidas == p->n) {
+        registrar_rota(p);
+        return;
+    }
+
+    int i, j;
+    if (!escolher_aresta(p, &i, &j)) return;
+
+    int marca = p->topo_trilha;
+    if (incluir(p, i, j) && p->limite < p->melhor_custo) {
+        busca_profundidade(p);
+    }
+    desfazer(p, marca);
+
+    if (excluir(p, i, j) && p->limite < p->melhor_custo) {
+        busca_profundidade(p);
+    }
+    desfazer(p, marca);
+}
+
+// Ordem da fila: menor limite primeiro, em empate o nó mais profundo
+bool vem_antes(const No* a, const No* b) {
+    if (a->limite != b->limite) return a->limite < b->limite;
+    return a->profundidade > b->profundidade;
+}
+
+void inserir_fila(No*** fila, int* tamanho, int* capacidade, No* no) {
+    if (*tamanho == *capacidade) {
+        *capacidade *= 2;
+        *fila = (No**)realloc(*fila, *capacidade * sizeof(No*));
+    }
+    int k = (*tamanho)++;
+    while (k > 0 && vem_antes(no, (*fila)[(k - 1) / 2])) {
+        (*fila)[k] = (*fila)[(k - 1) / 2];
+        k = (k - 1) / 2;
+    }
+    (*fila)[k] = no;
+}
+
+No* remover_fila(No** fila, int* tamanho) {
+    No* topo = fila[0];
+    No* ultimo = fila[--(*tamanho)];
+    int k = 0;
+    while (2 * k + 1 < *tamanho) {
+        int filho = 2 * k + 1;
+        if (filho + 1 < *tamanho && vem_antes(fila[filho + 1], fila[filho])) filho++;
+        if (!vem_antes(fila[filho], ultimo)) break;
+        fila[k] = fila[filho];
+        k = filho;
+    }
+    if (*tamanho > 0) fila[k] = ultimo;
+    return topo;
+}
+
+// Busca pelo melhor limite. Para ir de um nó a outro a matriz não é copiada: as decisões
+// são desfeitas até o ancestral comum e as do novo ramo são reaplicadas a partir dele.
+void busca_melhor_limite(Problema* p, int marca_raiz) {
+    int n = p->n;
+    int capacidade = 1024, tamanho = 0;
+    No** fila = (No**)malloc(capacidade * sizeof(No*));
+    int capacidade_nos = 1024, total_nos = 0;
+    No** todos = (No**)malloc(capacidade_nos * sizeof(No*));
+
+    // Ramo aplicado atualmente: atual[d] é o nó na profundidade d e marcas[d] o topo da trilha depois dele
+    No* atual[n * n + 1];
+    int marcas[n * n + 1];
+    No* cadeia[n * n + 1];
+    int profundidade_atual = 0;
+
+    No* raiz = (No*)calloc(1, sizeof(No));
+    raiz->limite = p->limite;
+    todos[total_nos++] = raiz;
+    atual[0] = raiz;
+    marcas[0] = marca_raiz;
+    inserir_fila(&fila, &tamanho, &capacidade, raiz);
+
+    while (tamanho > 0) {
+        No* no = remover_fila(fila, &tamanho);
+        if (no->limite >= p->melhor_custo) break; // Nenhum nó restante pode melhorar a rota
+
+        // Monta o caminho da raiz até o nó e volta até o ancestral comum com o ramo atual
+        for (No* k = no; k != NULL; k = k->pai) {
+            cadeia[k->profundidade] = k;
+        }
+        int comum = 0;
+        while (comum < profundidade_atual && comum < no->profundidade && atual[comum + 1] == cadeia[comum + 1]) {
+            comum++;
+        }
+        desfazer(p, marcas[comum]);
+        for (int d = comum + 1; d <= no->profundidade; d++) {
+            aplicar_decisao(p, cadeia[d]);
+            atual[d] = cadeia[d];
+            marcas[d] = p->topo_trilha;
+        }
+        profundidade_atual = no->profundidade;
+
+        p->nos++;
+        if (p->arestas_incluidas == n) {
+            registrar_rota(p);
+            continue;
+        }
+
+        int i, j;
+        if (!escolher_aresta(p, &i, &j)) continue;
+
+        // Avalia os dois filhos e guarda apenas a decisão e o limite de cada um
+        for (int inclui = 1; inclui >= 0; inclui--) {
+            No filho = {no, i, j, inclui, 0, no->profundidade + 1};
+            int marca = p->topo_trilha;
+            if (aplicar_decisao(p, &filho) && p->limite < p->melhor_custo) {
+                filho.limite = p->limite;
+                No* novo = (No*)malloc(sizeof(No));
+                *novo = filho;
+                if (total_nos == capacidade_nos) {
+                    capacidade_nos *= 2;
+                    todos = (No**)realloc(todos, capacidade_nos * sizeof(No*));
+                }
+                todos[total_nos++] = novo;
+                inserir_fila(&fila, &tamanho, &capacidade, novo);
+            }
+            desfazer(p, marca);
+        }
+    }
+
+    desfazer(p, marca_raiz);
+    for (int k = 0; k < total_nos; k++) {
+        free(todos[k]);
+    }
+    free(todos);
+    free(fila);
+}
+
+// Prepara o problema com a matriz da raiz já reduzida; retorna a marca da trilha da raiz
+int preparar_problema(Problema* p, const Instancia* instancia) {
+    int n = instancia->n;
+    p->n = n;
+    p->instancia = instancia;
+    p->matriz = (int**)malloc(n * sizeof(int*));
+    for (int i = 0; i < n; i++) {
+        p->matriz[i] = (int*)malloc(n * sizeof(int));
+        for (int j = 0; j < n; j++) {
+            // Custos iguais ao marcador são trazidos para baixo dele para continuarem válidos
+            int valor = custo(instancia, i, j);
+            if (valor >= INFINITO) valor = INFINITO - 1;
+            p->matriz[i][j] = (i == j) ? INFINITO : valor - instancia->min_saida[i];
+        }
+    }
+    p->linha_ativa = (int*)malloc(n * sizeof(int));
+    p->coluna_ativa = (int*)malloc(n * sizeof(int));
+    p->inicio = (int*)malloc(n * sizeof(int));
+    p->fim = (int*)malloc(n * sizeof(int));
+    p->sucessor = (int*)malloc(n * sizeof(int));
+    p->melhor_sucessor = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        p->linha_ativa[i] = p->coluna_ativa[i] = 1;
+        p->inicio[i] = p->fim[i] = i;
+        p->sucessor[i] = -1;
+    }
+    p->arestas_incluidas = 0;
+    p->limite = 0;
+    for (int i = 0; i < n; i++) {
+        p->limite = somar_limitado(p->limite, instancia->min_saida[i]); // Redução das linhas já feita com a tabela de menores saídas
+    }
+    p->capacidade_trilha = 4 * n * n;
+    p->trilha = (Alteracao*)malloc(p->capacidade_trilha * sizeof(Alteracao));
+    p->topo_trilha = 0;
+    p->nos = 0;
+    p->melhor_custo = INT_MAX; // Nenhuma rota encontrada ainda
+
+    // A redução das colunas da raiz é comum às duas estratégias e nunca é desfeita
+    reduzir(p);
+    return p->topo_trilha;
+}
+
+void liberar_problema(Problema* p) {
+    for (int i = 0; i < p->n; i++) {
+        free(p->matriz[i]);
+    }
+    free(p->matriz);
+    free(p->linha_ativa);
+    free(p->coluna_ativa);
+    free(p->inicio);
+    free(p->fim);
+    free(p->sucessor);
+    free(p->melhor_sucessor);
+    free(p->trilha);
+}
+
+// Função para escrever o resultado de uma estratégia no terminal e no arquivo
+void escrever_resultados(FILE* file, const char* estrategia, Problema* p, double tempo_execucao) {
+    FILE* destinos[2] = {stdout, file};
+    for (int d = 0; d < 2; d++) {
+        fprintf(destinos[d], "%s\n", estrategia);
+        if (p->melhor_custo == INT_MAX) {
+            fprintf(destinos[d], "Nenhuma rota encontrada.\n");
+        } else {
+            fprintf(destinos[d], "Melhor custo encontrado: %d\n", p->melhor_custo);
+            fprintf(destinos[d], "Melhor rota encontrada: ");
+            int cidade = 0;
+            for (int k = 0; k <= p->n; k++) {
+                fprintf(destinos[d], "%d ", cidade);
+                cidade = p->melhor_sucessor[cidade];
+            }
+            fprintf(destinos[d], "\n");
+        }
+        fprintf(destinos[d], "Nós expandidos: %ld\n", p->nos);
+        fprintf(destinos[d], "Tempo de execução: %.2f segundos\n\n", tempo_execucao);
+    }
+}
+
+// Função principal para encontrar a melhor rota com as duas estratégias de seleção de nós
+void encontrar_melhor_rota(const char* nome_arquivo) {
+    int n;
+    int** custos = ler_custos(nome_arquivo, &n);
+
+    if (n < 2) {
+        printf("São necessárias pelo menos 2 cidades\n");
+        for (int i = 0; i < n; i++) {
+            free(custos[i]);
+        }
+        free(custos);
+        exit(EXIT_FAILURE);
+    }
+
+    // Pré-processa a matriz de custos uma única vez para as duas estratégias
+    Instancia instancia;
+    preparar_instancia(&instancia, n, custos);
+    for (int i = 0; i < n; i++) {
+        free(custos[i]);
+    }
+    free(custos);
+
+    FILE* file = fopen("ramificacao_e_limite_resultado.txt", "w");
+    if (!file) {
+        printf("Erro ao abrir o arquivo ramificacao_e_limite_resultado.txt\n");
+        exit(EXIT_FAILURE);
+    }
+
+    Problema p;
+
+    // Busca em profundidade
+    int marca_raiz = preparar_problema(&p, &instancia);
+    clock_t inicio = clock();
+    busca_profundidade(&p);
+    clock_t fim = clock();
+    escrever_resultados(file, "Ramificação e limite (profundidade)", &p, (double)(fim - inicio) / CLOCKS_PER_SEC);
+    liberar_problema(&p);
+
+    // Busca pelo melhor limite
+    marca_raiz = preparar_problema(&p, &instancia);
+    inicio = clock();
+    busca_melhor_limite(&p, marca_raiz);
+    fim = clock();
+    escrever_resultados(file, "Ramificação e limite (melhor limite)", &p, (double)(fim - inicio) / CLOCKS_PER_SEC);
+    liberar_problema(&p);
+
+    fclose(file);
+    liberar_instancia(&instancia);
+}
+
+// Função principal
+int main(int argc, char* argv[]) {
+    // Nome do arquivo CSV contendo os custos (pode ser passado como argumento)
+    const char* nome_arquivo = (argc > 1) ? argv[1] : "cidades.csv";
+
+    // Chama a função para encontrar a melhor rota
+    encontrar_melhor_rota(nome_arquivo);
+
+    return 0;
+}